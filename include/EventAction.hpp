@@ -0,0 +1,23 @@
+#ifndef EVENT_ACTION_HPP
+#define EVENT_ACTION_HPP
+
+#include "G4UserEventAction.hh"
+#include "G4Event.hh"
+#include "RunTelemetry.hpp"
+
+class EventAction : public G4UserEventAction {
+public:
+    EventAction(RunTelemetry* telemetry) : telemetry(telemetry) {}
+
+    virtual ~EventAction() {}
+
+    virtual void EndOfEventAction(const G4Event*) override {
+        // Публикуем счетчики события для фонового потока телеметрии
+        telemetry->EndOfEvent();
+    }
+
+private:
+    RunTelemetry* telemetry;
+};
+
+#endif // EVENT_ACTION_HPP
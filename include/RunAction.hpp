@@ -7,11 +7,13 @@
 #include "G4UnitsTable.hh"
 #include "G4SystemOfUnits.hh"
 #include "DetectorConstruction.hpp"
+#include "RunTelemetry.hpp"
 
 class RunAction : public G4UserRunAction {
 public:
-    RunAction(DetectorConstruction* detConstruction) 
+    RunAction(DetectorConstruction* detConstruction, RunTelemetry* telemetry) 
         : detConstruction(detConstruction), 
+          telemetry(telemetry),
           totalEnergyDeposited(0.0), 
           totalTrackLength(0.0) {}
     
@@ -36,6 +38,10 @@ public:
         totalEnergyDeposited = 0.0;
         totalTrackLength = 0.0;
         
+        // Запускаем фоновую запись файла состояния
+        telemetry->Start(run->GetRunID(), run->GetNumberOfEventToBeProcessed(),
+                         detConstruction->GetPhantomMass());
+        
         G4cout << "### Run " << run->GetRunID() << " started." << G4endl;
     }
     
@@ -43,6 +49,9 @@ public:
         // Получаем анализ manager
         G4AnalysisManager* analysisManager = G4AnalysisManager::Instance();
         
+        // Останавливаем телеметрию и фиксируем итоговое состояние
+        telemetry->Stop();
+        
         // Нормализуем график распределения
         G4int numEvents = run->GetNumberOfEvent();
         // analysisManager->ScaleH1(0, 1.0 / numEvents);
@@ -93,6 +102,7 @@ public:
 
 private:
     DetectorConstruction* detConstruction;
+    RunTelemetry* telemetry;
     G4double totalEnergyDeposited;
     G4double totalTrackLength;
 };
@@ -0,0 +1,198 @@
+#ifndef RUN_TELEMETRY_HPP
+#define RUN_TELEMETRY_HPP
+
+#include "G4Types.hh"
+#include "G4String.hh"
+#include "G4SystemOfUnits.hh"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <thread>
+
+#include <unistd.h>
+
+// Телеметрия хода запуска: счетчики шагов и энерговыделения накапливаются
+// в потоковых переменных без синхронизации, раз в событие сбрасываются
+// в атомарные счетчики, а фоновый поток периодически переписывает
+// файл состояния. В горячем пути нет ни вывода, ни блокировок.
+class RunTelemetry {
+public:
+    RunTelemetry(const G4String& statusFile, G4double updateInterval = 1.0)
+        : statusFile(statusFile),
+          updateInterval(updateInterval),
+          eventsProcessed(0),
+          stepsProcessed(0),
+          energyDeposited(0.0),
+          eventsToProcess(0),
+          runID(-1),
+          phantomMass(0.0),
+          running(false),
+          stopRequested(false),
+          processID(getpid()) {
+        // Имя узла нужно монитору, чтобы сопоставить файл с заданием
+        char name[256] = {};
+        if (gethostname(name, sizeof(name) - 1) == 0) hostName = name;
+    }
+
+    virtual ~RunTelemetry() {
+        Stop();
+    }
+
+    // Вызывается из BeginOfRunAction: обнуляет счетчики и запускает фоновый поток
+    void Start(G4int id, G4int numberOfEvents, G4double massKg) {
+        Stop();
+
+        eventsProcessed.store(0, std::memory_order_relaxed);
+        stepsProcessed.store(0, std::memory_order_relaxed);
+        energyDeposited.store(0.0, std::memory_order_relaxed);
+        eventsToProcess = numberOfEvents;
+        runID = id;
+        phantomMass = massKg;
+        startTime = std::chrono::steady_clock::now();
+        LocalCounters() = Counters();
+
+        // Сразу затираем состояние предыдущего запуска
+        WriteStatus("running");
+
+        stopRequested = false;
+        running = true;
+        writer = std::thread(&RunTelemetry::WriterLoop, this);
+    }
+
+    // Вызывается из EndOfRunAction: останавливает поток и пишет итоговое состояние
+    void Stop() {
+        if (!running) return;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopRequested = true;
+        }
+        wakeup.notify_all();
+        writer.join();
+        running = false;
+        WriteStatus("finished");
+    }
+
+    // Горячий путь: только потоковые счетчики, без атомарных операций
+    void CountStep() {
+        ++LocalCounters().steps;
+    }
+
+    void AddEnergyDeposition(G4double energy) {
+        LocalCounters().energy += energy;
+    }
+
+    // Публикация накопленного за событие, вызывается из EndOfEventAction
+    void EndOfEvent() {
+        Counters& local = LocalCounters();
+        stepsProcessed.fetch_add(local.steps, std::memory_order_relaxed);
+        AtomicAdd(energyDeposited, local.energy);
+        eventsProcessed.fetch_add(1, std::memory_order_relaxed);
+        local = Counters();
+    }
+
+private:
+    struct Counters {
+        std::uint64_t steps = 0;
+        G4double energy = 0.0;
+    };
+
+    static Counters& LocalCounters() {
+        static thread_local Counters counters;
+        return counters;
+    }
+
+    static void AtomicAdd(std::atomic<G4double>& target, G4double value) {
+        G4double current = target.load(std::memory_order_relaxed);
+        while (!target.compare_exchange_weak(current, current + value,
+                                             std::memory_order_relaxed)) {}
+    }
+
+    void WriterLoop() {
+        std::unique_lock<std::mutex> lock(mutex);
+        const auto interval = std::chrono::duration<G4double>(updateInterval);
+        while (!wakeup.wait_for(lock, interval, [this] { return stopRequested; })) {
+            lock.unlock();
+            WriteStatus("running");
+            lock.lock();
+        }
+    }
+
+    void WriteStatus(const char* state) const {
+        const std::uint64_t events = eventsProcessed.load(std::memory_order_relaxed);
+        const std::uint64_t steps = stepsProcessed.load(std::memory_order_relaxed);
+        const G4double energy = energyDeposited.load(std::memory_order_relaxed);
+
+        const G4double elapsed = std::chrono::duration<G4double>(
+            std::chrono::steady_clock::now() - startTime).count();
+        const G4double eventsPerSecond = elapsed > 0.0 ? events / elapsed : 0.0;
+        const G4double stepsPerSecond = elapsed > 0.0 ? steps / elapsed : 0.0;
+
+        // Оценка оставшегося времени; -1, если скорость еще неизвестна
+        const G4bool finished = std::strcmp(state, "finished") == 0;
+        G4double eta = -1.0;
+        if (finished) {
+            eta = 0.0;
+        } else if (eventsPerSecond > 0.0 && eventsToProcess > 0) {
+            const G4double remaining = eventsToProcess > static_cast<G4int>(events)
+                ? eventsToProcess - static_cast<G4double>(events) : 0.0;
+            eta = remaining / eventsPerSecond;
+        }
+
+        // Доза в Греях (Джоуль/кг)
+        const G4double dose = phantomMass > 0.0 ? (energy / joule) / phantomMass : 0.0;
+
+        // Пишем во временный файл и переименовываем, чтобы монитор
+        // никогда не увидел частично записанное состояние
+        const G4String tmpFile = statusFile + ".tmp";
+        std::FILE* out = std::fopen(tmpFile.c_str(), "w");
+        if (!out) return;
+        std::fprintf(out,
+                     "state %s\n"
+                     "pid %ld\n"
+                     "host %s\n"
+                     "run_id %d\n"
+                     "events_processed %llu\n"
+                     "events_total %d\n"
+                     "elapsed_s %.3f\n"
+                     "events_per_s %.3f\n"
+                     "steps_processed %llu\n"
+                     "steps_per_s %.3f\n"
+                     "eta_s %.3f\n"
+                     "energy_deposit_MeV %.6e\n"
+                     "dose_Gy %.6e\n",
+                     state, static_cast<long>(processID), hostName.c_str(), runID,
+                     static_cast<unsigned long long>(events), eventsToProcess,
+                     elapsed, eventsPerSecond, static_cast<unsigned long long>(steps),
+                     stepsPerSecond, eta, energy / MeV, dose);
+        std::fclose(out);
+        std::rename(tmpFile.c_str(), statusFile.c_str());
+    }
+
+    G4String statusFile;
+    G4double updateInterval;  // период обновления файла, с
+
+    std::atomic<std::uint64_t> eventsProcessed;
+    std::atomic<std::uint64_t> stepsProcessed;
+    std::atomic<G4double> energyDeposited;
+
+    G4int eventsToProcess;
+    G4int runID;
+    G4double phantomMass;  // масса фантома, кг
+    std::chrono::steady_clock::time_point startTime;
+
+    std::thread writer;
+    std::mutex mutex;
+    std::condition_variable wakeup;
+    G4bool running;
+    G4bool stopRequested;
+
+    pid_t processID;
+    G4String hostName;
+};
+
+#endif // RUN_TELEMETRY_HPP
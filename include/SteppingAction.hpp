@@ -8,15 +8,18 @@
 #include "G4UnitsTable.hh"
 #include "RunAction.hpp"
 #include "DetectorConstruction.hpp"
+#include "RunTelemetry.hpp"
 
 class SteppingAction : public G4UserSteppingAction {
 public:
-    SteppingAction(RunAction* runAction, DetectorConstruction* detConstruction)
-        : runAction(runAction), detConstruction(detConstruction) {}
+    SteppingAction(RunAction* runAction, DetectorConstruction* detConstruction, RunTelemetry* telemetry)
+        : runAction(runAction), detConstruction(detConstruction), telemetry(telemetry) {}
     
     virtual ~SteppingAction() {}
     
     virtual void UserSteppingAction(const G4Step* step) override {
+        telemetry->CountStep();
+        
         // Получаем энергетические депозиты
         G4double energyDeposit = step->GetTotalEnergyDeposit();
         if (energyDeposit <= 0.0) return;
@@ -32,6 +35,7 @@ public:
             // Передаем энергию и длину трека в RunAction
             runAction->AddEnergyDeposition(energyDeposit);
             runAction->AddTrackLength(stepLength);
+            telemetry->AddEnergyDeposition(energyDeposit);
             
             // Вычисляем глубину в фантоме
             G4double depth = CalculateDepthInPhantom(step);
@@ -42,13 +46,6 @@ public:
             // Собираем дополнительную информацию о первичных частицах
             CollectPrimaryParticleInfo(step);
         }
-        
-        // Дополнительная информация для отладки (редкие события)
-        if (energyDeposit > 1*MeV && step->GetTrack()->GetCurrentStepNumber() == 1) {
-            G4cout << "Large energy deposit: " << G4BestUnit(energyDeposit, "Energy")
-                   << " by " << step->GetTrack()->GetParticleDefinition()->GetParticleName()
-                   << " at step " << step->GetTrack()->GetCurrentStepNumber() << G4endl;
-        }
     }
     
     G4double CalculateDepthInPhantom(const G4Step* step) {
@@ -75,11 +72,6 @@ public:
             // Первый шаг первичной частицы
             G4double primaryEnergy = track->GetKineticEnergy();
             runAction->FillParticleEnergy(primaryEnergy);
-            
-            if (track->GetTrackID() % 1000 == 1) {
-                G4cout << "Primary " << track->GetParticleDefinition()->GetParticleName()
-                       << " energy: " << G4BestUnit(primaryEnergy, "Energy") << G4endl;
-            }
         }
     }
     
@@ -97,6 +89,7 @@ public:
 private:
     RunAction* runAction;
     DetectorConstruction* detConstruction;
+    RunTelemetry* telemetry;
 };
 
 #endif // STEPPING_ACTION_HPP
\ No newline at end of file
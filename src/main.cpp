@@ -4,11 +4,17 @@
 #include "G4VisExecutive.hh"
 #include "G4UIExecutive.hh"
 
+#include <cstdlib>
+#include <string>
+#include <unistd.h>
+
 #include "DetectorConstruction.hpp"
 #include "PhysicsList.hpp"
 #include "PrimaryGeneratorAction.hpp"
 #include "RunAction.hpp"
+#include "EventAction.hpp"
 #include "SteppingAction.hpp"
+#include "RunTelemetry.hpp"
 
 int main(int argc, char** argv) {
     // Инициализация ядра Geant4
@@ -28,10 +34,22 @@ int main(int argc, char** argv) {
     PrimaryGeneratorAction* generatorAction = new PrimaryGeneratorAction();
     runManager->SetUserAction(generatorAction);
     
-    RunAction* runAction = new RunAction(detector);
+    // Телеметрия хода запуска: файл состояния обновляется раз в секунду.
+    // Путь задается переменной DOSE_TELEMETRY_FILE, по умолчанию в имя
+    // файла добавляется PID, чтобы задания на одном узле не мешали друг другу
+    const char* telemetryEnv = std::getenv("DOSE_TELEMETRY_FILE");
+    G4String telemetryFile = (telemetryEnv && *telemetryEnv)
+        ? G4String(telemetryEnv)
+        : G4String("/tmp/dose_progress_" + std::to_string(getpid()) + ".txt");
+    RunTelemetry* telemetry = new RunTelemetry(telemetryFile, 1.0);
+    
+    RunAction* runAction = new RunAction(detector, telemetry);
     runManager->SetUserAction(runAction);
     
-    SteppingAction* steppingAction = new SteppingAction(runAction, detector);
+    EventAction* eventAction = new EventAction(telemetry);
+    runManager->SetUserAction(eventAction);
+    
+    SteppingAction* steppingAction = new SteppingAction(runAction, detector, telemetry);
     runManager->SetUserAction(steppingAction);
     
     // Настройка визуализации и сессии
@@ -59,6 +77,7 @@ int main(int argc, char** argv) {
     delete uiExecutive;
     delete visManager;
     delete runManager;
+    delete telemetry;
     
     return 0;
 }
\ No newline at end of file